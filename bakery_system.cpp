@@ -6,7 +6,16 @@
 #include <algorithm>
 #include <ctime>
 #include <map>
+#include <unordered_map>
+#include <set>
 #include <sstream>
+#include <cctype>
+#include <cstdlib>
+#include <cstdint>
+#include <functional>
+#include <climits>
+#include <chrono>
+#include <random>
 
 using namespace std;
 
@@ -197,28 +206,553 @@ public:
     }
 };
 
+class ProductSearchIndex {
+private:
+    // (-units sold, product ID): best sellers sort first, ties by lowest ID.
+    typedef pair<int, int> Rank;
+    
+    static const int kTopSize = 32;
+    static const int kMinTopSize = 16;
+    static const int kMaxTypoRows = 512;
+    static const int kMaxRejected = 256;
+    
+    struct TrieNode {
+        char ch;
+        int parent;
+        int depth;
+        int firstChild;
+        int nextSibling;
+        int count;           // products with a word under this prefix
+        int posting;         // index into postings when a word ends here
+        vector<Rank> top;    // exact best sellers under this prefix, best first
+        
+        TrieNode(char c, int p, int d)
+            : ch(c), parent(p), depth(d), firstChild(-1), nextSibling(-1),
+              count(0), posting(-1) {}
+    };
+    
+    // A product word: its trie node and its first eight characters packed
+    // into an integer, so most prefix checks never touch the trie.
+    struct Word {
+        int node;
+        uint64_t head;
+    };
+    
+    struct Entry {
+        vector<Word> words;
+        int sold;
+        bool indexed;
+        
+        Entry() : sold(0), indexed(false) {}
+    };
+    
+    // A query term resolved to the disjoint trie prefixes it matches.
+    struct Term {
+        vector<int> nodes;
+        vector<pair<uint64_t, uint64_t>> heads;   // packed prefix and mask per node
+        size_t count;
+        
+        Term() : count(0) {}
+    };
+    
+    // Walks the products under one or more prefixes in popularity order.
+    // Each prefix serves its cached top list first; only once that runs out
+    // is it replaced by its own posting and its children's top lists, so a
+    // query pays for the depth it actually reads rather than the subtree.
+    class PrefixCursor {
+    private:
+        struct Source {
+            int node;                          // -1 for a word posting
+            size_t position;                   // next entry of the node's top list
+            set<Rank>::const_iterator next, end;
+        };
+        
+        const ProductSearchIndex& index;
+        vector<Source> sources;
+        vector<pair<Rank, int>> heap;          // head rank and source
+        bool hasLast;
+        Rank last;                             // last rank returned
+        
+        static bool later(const pair<Rank, int>& a, const pair<Rank, int>& b) {
+            return a.first > b.first;
+        }
+        
+        // Everything at or before the last returned rank has been returned
+        // already, so sources skip ahead of it.
+        void advance(int s) {
+            while (true) {
+                Source& source = sources[s];
+                Rank rank;
+                if (source.node == -1) {
+                    if (source.next == source.end) return;
+                    rank = *source.next++;
+                } else {
+                    const TrieNode& node = index.nodes[source.node];
+                    if (source.position == node.top.size()) {
+                        if (node.top.size() < static_cast<size_t>(node.count)) {
+                            expand(source.node);
+                        }
+                        return;
+                    }
+                    rank = node.top[source.position++];
+                }
+                if (!hasLast || last < rank) {
+                    heap.push_back({rank, s});
+                    push_heap(heap.begin(), heap.end(), later);
+                    return;
+                }
+            }
+        }
+        
+        void addTopList(int node) {
+            sources.push_back({node, 0, set<Rank>::const_iterator(), set<Rank>::const_iterator()});
+            advance(static_cast<int>(sources.size()) - 1);
+        }
+        
+        void expand(int node) {
+            const TrieNode& current = index.nodes[node];
+            if (current.posting != -1) {
+                const set<Rank>& posting = index.postings[current.posting];
+                sources.push_back({-1, 0, hasLast ? posting.upper_bound(last) : posting.begin(),
+                                   posting.end()});
+                advance(static_cast<int>(sources.size()) - 1);
+            }
+            for (int child = current.firstChild; child != -1; child = index.nodes[child].nextSibling) {
+                if (index.nodes[child].count > 0) addTopList(child);
+            }
+        }
+        
+    public:
+        PrefixCursor(const ProductSearchIndex& owner, const vector<int>& roots)
+            : index(owner), hasLast(false) {
+            for (int root : roots) addTopList(root);
+        }
+        
+        bool next(Rank& rank) {
+            while (!heap.empty()) {
+                pop_heap(heap.begin(), heap.end(), later);
+                pair<Rank, int> head = heap.back();
+                heap.pop_back();
+                bool fresh = !hasLast || last < head.first;
+                if (fresh) {
+                    last = head.first;
+                    hasLast = true;
+                }
+                advance(head.second);
+                if (fresh) {
+                    rank = head.first;
+                    return true;
+                }
+            }
+            return false;
+        }
+    };
+    
+    vector<TrieNode> nodes;
+    vector<set<Rank>> postings;
+    vector<Entry> entries;     // by product ID, which Product hands out sequentially
+    
+    static vector<string> tokenize(const string& text) {
+        vector<string> words;
+        string word;
+        for (char c : text) {
+            if (isalnum(static_cast<unsigned char>(c))) {
+                word += static_cast<char>(tolower(static_cast<unsigned char>(c)));
+            } else if (!word.empty()) {
+                words.push_back(word);
+                word.clear();
+            }
+        }
+        if (!word.empty()) {
+            words.push_back(word);
+        }
+        return words;
+    }
+    
+    static int maxTypos(const string& term) {
+        if (term.size() < 3) return 0;
+        if (term.size() <= 5) return 1;
+        return 2;
+    }
+    
+    static void insertTop(vector<Rank>& top, const Rank& rank) {
+        top.insert(lower_bound(top.begin(), top.end(), rank), rank);
+        if (top.size() > static_cast<size_t>(kTopSize)) top.pop_back();
+    }
+    
+    static bool eraseTop(vector<Rank>& top, const Rank& rank) {
+        auto it = lower_bound(top.begin(), top.end(), rank);
+        if (it == top.end() || *it != rank) return false;
+        top.erase(it);
+        return true;
+    }
+    
+    static uint64_t packHead(const string& word) {
+        uint64_t head = 0;
+        for (size_t i = 0; i < 8; ++i) {
+            unsigned char c = i < word.size() ? static_cast<unsigned char>(word[i]) : 0;
+            head = (head << 8) | c;
+        }
+        return head;
+    }
+    
+    string prefixText(int node) const {
+        string text(nodes[node].depth, ' ');
+        for (int n = node; n != 0; n = nodes[n].parent) {
+            text[nodes[n].depth - 1] = nodes[n].ch;
+        }
+        return text;
+    }
+    
+    Entry* findEntry(int productID) {
+        if (productID < 0 || static_cast<size_t>(productID) >= entries.size()) return nullptr;
+        return entries[productID].indexed ? &entries[productID] : nullptr;
+    }
+    
+    int findChild(int node, char c) const {
+        for (int child = nodes[node].firstChild; child != -1; child = nodes[child].nextSibling) {
+            if (nodes[child].ch == c) return child;
+        }
+        return -1;
+    }
+    
+    int insertWord(const string& word) {
+        int node = 0;
+        for (char c : word) {
+            int child = findChild(node, c);
+            if (child == -1) {
+                child = static_cast<int>(nodes.size());
+                nodes.push_back(TrieNode(c, node, nodes[node].depth + 1));
+                nodes[child].nextSibling = nodes[node].firstChild;
+                nodes[node].firstChild = child;
+            }
+            node = child;
+        }
+        if (nodes[node].posting == -1) {
+            nodes[node].posting = static_cast<int>(postings.size());
+            postings.push_back(set<Rank>());
+        }
+        return node;
+    }
+    
+    int findPrefix(const string& prefix) const {
+        int node = 0;
+        for (char c : prefix) {
+            node = findChild(node, c);
+            if (node == -1) return -1;
+        }
+        return nodes[node].count > 0 ? node : -1;
+    }
+    
+    // Every non-root prefix of the given words, each listed once.
+    vector<int> prefixNodes(const vector<Word>& words) const {
+        vector<int> prefixes;
+        for (const auto& word : words) {
+            for (int n = word.node; n != 0; n = nodes[n].parent) {
+                prefixes.push_back(n);
+            }
+        }
+        sort(prefixes.begin(), prefixes.end());
+        prefixes.erase(unique(prefixes.begin(), prefixes.end()), prefixes.end());
+        return prefixes;
+    }
+    
+    bool isUnder(int node, int prefix) const {
+        while (nodes[node].depth > nodes[prefix].depth) {
+            node = nodes[node].parent;
+        }
+        return node == prefix;
+    }
+    
+    // Rebuilds a node's top list from its own postings and its children's
+    // top lists. A truncated source is only exact down to its last entry,
+    // so the merge is cut there; that still leaves at least kMinTopSize.
+    void refill(int node) {
+        vector<Rank> merged;
+        Rank bound(INT_MAX, INT_MAX);
+        if (nodes[node].posting != -1) {
+            const set<Rank>& posting = postings[nodes[node].posting];
+            for (const auto& rank : posting) {
+                if (merged.size() == static_cast<size_t>(kTopSize)) {
+                    bound = min(bound, merged.back());
+                    break;
+                }
+                merged.push_back(rank);
+            }
+        }
+        for (int child = nodes[node].firstChild; child != -1; child = nodes[child].nextSibling) {
+            const TrieNode& next = nodes[child];
+            merged.insert(merged.end(), next.top.begin(), next.top.end());
+            if (next.top.size() < static_cast<size_t>(next.count)) {
+                bound = min(bound, next.top.back());
+            }
+        }
+        sort(merged.begin(), merged.end());
+        merged.erase(unique(merged.begin(), merged.end()), merged.end());
+        merged.erase(upper_bound(merged.begin(), merged.end(), bound), merged.end());
+        if (merged.size() > static_cast<size_t>(kTopSize)) merged.resize(kTopSize);
+        nodes[node].top = merged;
+    }
+    
+    // Best-first walk of the trie with an optimal string alignment (Damerau)
+    // distance table. A prefix within maxDist of the whole term matches with
+    // its entire subtree; a branch is pruned once every cell exceeds maxDist.
+    // Prefixes are explored closest first, and the walk stops after
+    // kMaxTypoRows tables. In a dense vocabulary, such as a million product
+    // codes, the cap drops only the most distant candidates.
+    void fuzzyWalk(const string& term, int maxDist, Term& result) const {
+        struct State {
+            int node;
+            int row;          // offset of this prefix's row in the pool
+            int parentRow;    // offset of the parent prefix's row, -1 at the root
+            bool matched;
+        };
+        typedef pair<pair<int, int>, int> Entry;   // (distance bound, -depth), state
+        
+        int width = static_cast<int>(term.size()) + 1;
+        vector<int> pool(width);
+        for (int j = 0; j < width; ++j) pool[j] = j;
+        vector<State> states = {{0, 0, -1, false}};
+        vector<Entry> frontier = {{{0, 0}, 0}};
+        int budget = kMaxTypoRows;
+        
+        while (!frontier.empty() && budget > 0) {
+            pop_heap(frontier.begin(), frontier.end(), greater<Entry>());
+            State state = states[frontier.back().second];
+            frontier.pop_back();
+            if (state.matched) {
+                result.nodes.push_back(state.node);
+                result.count += nodes[state.node].count;
+                continue;
+            }
+            
+            char previous = nodes[state.node].ch;
+            for (int child = nodes[state.node].firstChild; child != -1 && budget > 0;
+                 child = nodes[child].nextSibling) {
+                if (nodes[child].count == 0) continue;
+                --budget;
+                
+                char c = nodes[child].ch;
+                int row = static_cast<int>(pool.size());
+                pool.resize(pool.size() + width);
+                pool[row] = nodes[child].depth;
+                int rowMin = pool[row];
+                for (int j = 1; j < width; ++j) {
+                    int cost = (term[j - 1] == c) ? 0 : 1;
+                    int best = min({pool[state.row + j] + 1, pool[row + j - 1] + 1,
+                                    pool[state.row + j - 1] + cost});
+                    if (state.parentRow != -1 && j > 1 &&
+                        c == term[j - 2] && previous == term[j - 1]) {
+                        best = min(best, pool[state.parentRow + j - 2] + 1);
+                    }
+                    pool[row + j] = best;
+                    rowMin = min(rowMin, best);
+                }
+                
+                int distance = pool[row + width - 1];
+                if (distance > maxDist && rowMin > maxDist) {
+                    pool.resize(row);
+                    continue;
+                }
+                bool matched = distance <= maxDist;
+                states.push_back({child, row, state.row, matched});
+                frontier.push_back({{matched ? distance : rowMin, -nodes[child].depth},
+                                    static_cast<int>(states.size()) - 1});
+                push_heap(frontier.begin(), frontier.end(), greater<Entry>());
+            }
+        }
+        
+        // Matches already found are kept even when the budget ran out.
+        for (const auto& entry : frontier) {
+            const State& state = states[entry.second];
+            if (state.matched) {
+                result.nodes.push_back(state.node);
+                result.count += nodes[state.node].count;
+            }
+        }
+    }
+    
+    // Products with a word that starts with term, falling back to words that
+    // start within a small edit distance of it when nothing matches exactly.
+    Term resolveTerm(const string& term) const {
+        Term result;
+        int node = findPrefix(term);
+        if (node != -1) {
+            result.nodes.push_back(node);
+            result.count = nodes[node].count;
+        } else if (maxTypos(term) > 0) {
+            fuzzyWalk(term, maxTypos(term), result);
+        }
+        
+        for (int prefix : result.nodes) {
+            size_t length = min(static_cast<size_t>(nodes[prefix].depth), static_cast<size_t>(8));
+            result.heads.push_back({packHead(prefixText(prefix)), ~0ULL << (64 - 8 * length)});
+        }
+        return result;
+    }
+    
+    bool matchesTerm(const Entry& entry, const Term& term) const {
+        for (const auto& word : entry.words) {
+            for (size_t i = 0; i < term.nodes.size(); ++i) {
+                if ((word.head & term.heads[i].second) != term.heads[i].first) continue;
+                if (nodes[term.nodes[i]].depth <= 8 || isUnder(word.node, term.nodes[i])) {
+                    return true;
+                }
+            }
+        }
+        return false;
+    }
+    
+public:
+    ProductSearchIndex() {
+        nodes.push_back(TrieNode('\0', -1, 0));
+    }
+    
+    void addProduct(const Product& product) {
+        vector<string> words = tokenize(product.name + " " + product.category);
+        sort(words.begin(), words.end());
+        words.erase(unique(words.begin(), words.end()), words.end());
+        
+        if (product.productID < 0 || findEntry(product.productID)) return;
+        if (static_cast<size_t>(product.productID) >= entries.size()) {
+            entries.resize(product.productID + 1);
+        }
+        Entry& entry = entries[product.productID];
+        entry.indexed = true;
+        Rank rank(-entry.sold, product.productID);
+        for (const auto& word : words) {
+            int node = insertWord(word);
+            entry.words.push_back({node, packHead(word)});
+            postings[nodes[node].posting].insert(rank);
+        }
+        
+        for (int n : prefixNodes(entry.words)) {
+            TrieNode& node = nodes[n];
+            bool complete = node.top.size() == static_cast<size_t>(node.count);
+            node.count++;
+            if (complete || (!node.top.empty() && rank < node.top.back())) {
+                insertTop(node.top, rank);
+            }
+        }
+    }
+    
+    void removeProduct(int productID) {
+        Entry* entry = findEntry(productID);
+        if (!entry) return;
+        
+        Rank rank(-entry->sold, productID);
+        for (const auto& word : entry->words) {
+            postings[nodes[word.node].posting].erase(rank);
+        }
+        vector<int> prefixes = prefixNodes(entry->words);
+        *entry = Entry();
+        
+        // Dropping an entry leaves the rest of a top list exact; it only has
+        // to be rebuilt once it runs short. Children have higher indices than
+        // their parents, so walking backwards rebuilds them first.
+        for (auto p = prefixes.rbegin(); p != prefixes.rend(); ++p) {
+            int n = *p;
+            TrieNode& node = nodes[n];
+            node.count--;
+            eraseTop(node.top, rank);
+            if (node.top.size() < static_cast<size_t>(min(static_cast<int>(kMinTopSize), node.count))) {
+                refill(n);
+            }
+        }
+    }
+    
+    void recordSale(int productID, int quantity) {
+        Entry* entry = findEntry(productID);
+        if (!entry || quantity <= 0) return;
+        
+        Rank oldRank(-entry->sold, productID);
+        entry->sold += quantity;
+        Rank newRank(-entry->sold, productID);
+        for (const auto& word : entry->words) {
+            set<Rank>& posting = postings[nodes[word.node].posting];
+            posting.erase(oldRank);
+            posting.insert(newRank);
+        }
+        
+        // A product can only move up, so it joins a top list it was not on
+        // once it overtakes that list's last entry.
+        for (int n : prefixNodes(entry->words)) {
+            vector<Rank>& top = nodes[n].top;
+            if (eraseTop(top, oldRank) || (!top.empty() && newRank < top.back())) {
+                insertTop(top, newRank);
+            }
+        }
+    }
+    
+    // Returns IDs of products matching every term of the query, most sold first.
+    vector<int> search(const string& query, size_t maxResults = 10) const {
+        vector<string> words = tokenize(query);
+        if (words.empty() || maxResults == 0) return {};
+        
+        vector<Term> terms;
+        for (const auto& word : words) {
+            terms.push_back(resolveTerm(word));
+            if (terms.back().count == 0) return {};
+        }
+        sort(terms.begin(), terms.end(),
+             [](const Term& a, const Term& b) { return a.count < b.count; });
+        
+        // Candidates come from the most selective term in popularity order,
+        // so the search stops as soon as maxResults of them match. Terms that
+        // rarely occur together stop after kMaxRejected failed candidates and
+        // may then return fewer than maxResults products.
+        vector<int> results;
+        PrefixCursor cursor(*this, terms[0].nodes);
+        Rank rank;
+        int rejected = 0;
+        while (results.size() < maxResults && rejected < kMaxRejected && cursor.next(rank)) {
+            const Entry& entry = entries[rank.second];
+            bool matchesAll = true;
+            for (size_t i = 1; i < terms.size() && matchesAll; ++i) {
+                matchesAll = matchesTerm(entry, terms[i]);
+            }
+            if (matchesAll) {
+                results.push_back(rank.second);
+            } else {
+                ++rejected;
+            }
+        }
+        return results;
+    }
+};
+
 class Inventory {
 private:
     vector<Product> products;
+    unordered_map<int, size_t> positions;
+    ProductSearchIndex searchIndex;
     
 public:
     void addProduct(const Product& product) {
+        positions[product.productID] = products.size();
         products.push_back(product);
+        searchIndex.addProduct(product);
     }
     
     void removeProduct(int productID) {
-        products.erase(
-            remove_if(products.begin(), products.end(),
-                [productID](const Product& p) { return p.productID == productID; }),
-            products.end()
-        );
+        auto it = positions.find(productID);
+        if (it == positions.end()) return;
+        
+        // Erase in place so the menu keeps its order; only products after
+        // the erase point move.
+        size_t index = it->second;
+        positions.erase(it);
+        products.erase(products.begin() + index);
+        for (size_t i = index; i < products.size(); ++i) {
+            positions[products[i].productID] = i;
+        }
+        searchIndex.removeProduct(productID);
     }
     
     Product* findProduct(int productID) {
-        for (auto& product : products) {
-            if (product.productID == productID) {
-                return &product;
-            }
+        auto it = positions.find(productID);
+        if (it != positions.end()) {
+            return &products[it->second];
         }
         return nullptr;
     }
@@ -254,6 +788,25 @@ public:
         cout << "===========================\n";
     }
     
+    void displaySearchResults(const string& query) const {
+        cout << "\n========== SEARCH: " << query << " ==========\n";
+        cout << left << setw(5) << "ID" 
+             << setw(20) << "Name" 
+             << setw(15) << "Category"
+             << setw(10) << "Price"
+             << setw(10) << "Stock" << endl;
+        cout << "------------------------------------------------\n";
+        
+        vector<int> results = searchProducts(query);
+        for (int id : results) {
+            products[positions.at(id)].displayProduct();
+        }
+        if (results.empty()) {
+            cout << "No products match your search.\n";
+        }
+        cout << "================================\n";
+    }
+    
     void checkLowStock() const {
         cout << "\n========== LOW STOCK ALERT ==========\n";
         bool found = false;
@@ -270,6 +823,14 @@ public:
     }
     
     vector<Product>& getProducts() { return products; }
+    
+    void recordSale(int productID, int quantity) {
+        searchIndex.recordSale(productID, quantity);
+    }
+    
+    vector<int> searchProducts(const string& query, size_t maxResults = 10) const {
+        return searchIndex.search(query, maxResults);
+    }
 };
 
 class SalesReport {
@@ -364,7 +925,8 @@ public:
         cout << "5. View Current Order\n";
         cout << "6. Checkout & Pay\n";
         cout << "7. Register as Customer\n";
-        cout << "8. Back to Main Menu\n";
+        cout << "8. Search Products\n";
+        cout << "9. Back to Main Menu\n";
         cout << "==================================\n";
         cout << "Select option: ";
     }
@@ -413,6 +975,9 @@ public:
                     registerCustomer();
                     break;
                 case 8:
+                    searchProducts();
+                    break;
+                case 9:
                     return;
                 default:
                     cout << "Invalid option! Please try again.\n";
@@ -436,6 +1001,15 @@ public:
         }
     }
     
+    void searchProducts() {
+        string query;
+        cout << "Enter search text: ";
+        cin.ignore();
+        getline(cin, query);
+        
+        inventory.displaySearchResults(query);
+    }
+    
     void addItemToCart() {
         inventory.displayAllProducts();
         
@@ -502,6 +1076,7 @@ public:
         if (confirm == 'y' || confirm == 'Y') {
             for (const auto& item : currentOrder.items) {
                 item.product->updateStock(item.quantity);
+                inventory.recordSale(item.product->productID, item.quantity);
             }
             
             salesReport.addOrder(currentOrder);
@@ -667,7 +1242,149 @@ public:
     }
 };
 
-int main() {
+double percentile(vector<double> samples, double fraction) {
+    if (samples.empty()) return 0.0;
+    sort(samples.begin(), samples.end());
+    size_t index = static_cast<size_t>(fraction * samples.size());
+    return samples[min(index, samples.size() - 1)];
+}
+
+// Queries report their average result count and whether p99 meets the
+// 100us target; updates pass a negative averageHits and show neither.
+void printTimings(const string& label, const vector<double>& samples, double averageHits = -1.0) {
+    double p99 = percentile(samples, 0.99);
+    cout << left << setw(22) << label
+         << right << setw(8) << samples.size()
+         << setw(12) << fixed << setprecision(1) << percentile(samples, 0.50)
+         << setw(12) << p99
+         << setw(12) << percentile(samples, 1.0);
+    if (averageHits >= 0) {
+        cout << setw(8) << averageHits << setw(8) << (p99 <= 100.0 ? "ok" : "OVER");
+    } else {
+        cout << setw(8) << "-" << setw(8) << "-";
+    }
+    cout << endl;
+}
+
+// Builds a synthetic catalog and reports search and update latencies in
+// microseconds. Run with: ./bakery --bench [productCount]
+void runSearchBenchmark(int productCount) {
+    const string words[] = {"chocolate", "vanilla", "cake", "croissant", "sourdough",
+                            "cookie", "chip", "apple", "pie", "coffee"};
+    const string categories[] = {"Cakes", "Pastries", "Bread", "Cookies", "Drinks"};
+    const int queryCount = 2000;
+    mt19937 rng(2024);
+    
+    auto elapsed = [](chrono::steady_clock::time_point start) {
+        return chrono::duration<double, micro>(chrono::steady_clock::now() - start).count();
+    };
+    
+    Inventory inventory;
+    
+    auto buildStart = chrono::steady_clock::now();
+    for (int i = 0; i < productCount; ++i) {
+        string name = words[rng() % 10] + " " + words[rng() % 10] + " x" + to_string(i);
+        inventory.addProduct(Product(name, categories[rng() % 5], 1.99, 10));
+    }
+    double buildSeconds = elapsed(buildStart) / 1e6;
+    
+    // Skewed sales so a few products dominate the rankings.
+    vector<double> saleTimes;
+    vector<Product>& products = inventory.getProducts();
+    for (int i = 0; i < productCount / 5; ++i) {
+        size_t pick = (static_cast<size_t>(rng() % products.size()) * (rng() % 1000)) / 1000;
+        int quantity = 1 + rng() % 5;
+        auto start = chrono::steady_clock::now();
+        inventory.recordSale(products[pick].productID, quantity);
+        saleTimes.push_back(elapsed(start));
+    }
+    
+    auto timeQueries = [&](const string& label, const vector<string>& queries) {
+        vector<double> samples;
+        size_t hits = 0;
+        for (const auto& query : queries) {
+            auto start = chrono::steady_clock::now();
+            vector<int> results = inventory.searchProducts(query);
+            samples.push_back(elapsed(start));
+            hits += results.size();
+        }
+        printTimings(label, samples, static_cast<double>(hits) / queries.size());
+    };
+    
+    auto randomWord = [&]() { return words[rng() % 10]; };
+    auto randomPrefix = [&](const string& word, size_t minLength) {
+        return word.substr(0, minLength + rng() % (word.size() - minLength + 1));
+    };
+    auto randomCode = [&]() { return "x" + to_string(rng() % productCount); };
+    auto misspell = [&](string word) {
+        size_t pos = 1 + rng() % (word.size() - 1);
+        char letter = static_cast<char>('a' + rng() % 26);
+        switch (rng() % 4) {
+            case 0: word[pos] = letter; break;
+            case 1: word.erase(pos, 1); break;
+            case 2: word.insert(pos, 1, letter); break;
+            default: if (pos + 1 < word.size()) swap(word[pos], word[pos + 1]); break;
+        }
+        return word;
+    };
+    
+    vector<string> prefixQueries, categoryQueries, multiQueries, typoQueries, rareQueries;
+    vector<string> categoryMixQueries, codeMixQueries, sparseQueries, codeTypoQueries;
+    for (int i = 0; i < queryCount; ++i) {
+        prefixQueries.push_back(randomPrefix(randomWord(), 1));
+        categoryQueries.push_back(randomPrefix(categories[rng() % 5], 2));
+        multiQueries.push_back(randomPrefix(randomWord(), 3) + " " + randomPrefix(randomWord(), 3));
+        rareQueries.push_back(randomCode());
+        typoQueries.push_back(misspell(randomWord()));
+        
+        // Mixed selectivity: a broad word with a category, or with a short
+        // code prefix such as "x5", and three words narrowed by a code prefix.
+        string codePrefix = randomPrefix(randomCode(), 2).substr(0, 2 + rng() % 2);
+        categoryMixQueries.push_back(randomWord() + " " + randomPrefix(categories[rng() % 5], 3));
+        codeMixQueries.push_back(randomWord() + " " + codePrefix);
+        sparseQueries.push_back(randomWord() + " " + randomWord() + " " + randomWord() + " " + codePrefix);
+        codeTypoQueries.push_back(misspell(randomCode()));
+    }
+    
+    cout << "\n========== SEARCH BENCHMARK ==========\n";
+    cout << "Products: " << productCount
+         << " (indexed in " << fixed << setprecision(2) << buildSeconds << "s)\n";
+    cout << left << setw(22) << "Operation"
+         << right << setw(8) << "Runs"
+         << setw(12) << "p50 (us)"
+         << setw(12) << "p99 (us)"
+         << setw(12) << "max (us)"
+         << setw(8) << "Hits"
+         << setw(8) << "<100us" << endl;
+    cout << "----------------------------------------------------------------------------------\n";
+    timeQueries("Prefix", prefixQueries);
+    timeQueries("Category prefix", categoryQueries);
+    timeQueries("Multi-term", multiQueries);
+    timeQueries("Word + category", categoryMixQueries);
+    timeQueries("Word + code prefix", codeMixQueries);
+    timeQueries("3 words + code prefix", sparseQueries);
+    timeQueries("Typo", typoQueries);
+    timeQueries("Code typo", codeTypoQueries);
+    timeQueries("Rare token", rareQueries);
+    printTimings("Record sale", saleTimes);
+    
+    vector<double> removeTimes;
+    for (int i = 0; i < 200; ++i) {
+        int productID = products[rng() % products.size()].productID;
+        auto start = chrono::steady_clock::now();
+        inventory.removeProduct(productID);
+        removeTimes.push_back(elapsed(start));
+    }
+    printTimings("Remove product", removeTimes);
+    cout << "======================================\n";
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && string(argv[1]) == "--bench") {
+        runSearchBenchmark(argc > 2 ? atoi(argv[2]) : 1000000);
+        return 0;
+    }
+    
     BakerySystem bakery;
     bakery.run();
     return 0;